@@ -0,0 +1,27 @@
+#include "raylib.h"
+
+#ifndef INPUT_QQ_H
+#define INPUT_QQ_H
+
+typedef enum InputMode {
+    INPUT_MODE_LIVE = 0,    // Read input straight from raylib
+    INPUT_MODE_RECORD,      // Read input from raylib and append every frame to a file
+    INPUT_MODE_REPLAY,      // Feed frames back from a recorded file
+} InputMode;
+
+bool InitInput(InputMode mode, const char *fileName);
+void CloseInput(void);
+bool PollFrameInput(void);
+InputMode GetInputMode(void);
+
+int InputScreenWidth(void);
+int InputScreenHeight(void);
+bool InputWindowFocused(void);
+bool InputKeyDown(int key);
+bool InputKeyPressed(int key);
+bool InputMouseButtonPressed(int button);
+bool InputMouseButtonReleased(int button);
+Vector2 InputMousePosition(void);
+float InputMouseWheelMove(void);
+
+#endif
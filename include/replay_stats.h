@@ -0,0 +1,28 @@
+#include "raylib.h"
+#include <stdio.h>
+#include <stdint.h>
+
+#ifndef REPLAY_STATS_QQ_H
+#define REPLAY_STATS_QQ_H
+
+typedef struct ReplayStats {
+    RenderTexture2D target; // frames are drawn here at the recorded size, independent of the OS window
+    FILE *report;           // per-frame CSV: frame, milliseconds, frame hash
+    int hashEvery;          // hash every Nth frame, 0 disables hashing
+    int frames;             // frames with a finished timing
+    bool inFrame;           // a frame was started and its timing is still open
+    double frameStart;
+    bool frameHashed;
+    uint64_t frameHash;
+    double totalMs;
+    double minMs;
+    double maxMs;
+    uint64_t checksum;      // hash of all frame hashes, changes if any hashed frame renders differently
+} ReplayStats;
+
+bool InitReplayStats(ReplayStats *stats, const char *reportFileName, int hashEvery);
+void CloseReplayStats(ReplayStats *stats);
+void BeginReplayFrame(ReplayStats *stats, int width, int height);
+void EndReplayFrame(ReplayStats *stats);
+
+#endif
@@ -0,0 +1,43 @@
+#!/bin/sh
+# Replays every recordings/*.qqi and checks it against recordings/<name>.checksum when one exists.
+# Usage: scripts/run_replays.sh <path to QQ binary> [--update]
+#   --update  replays each recording once and (re)writes its .checksum from the result
+set -u
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 <path to QQ binary> [--update]" >&2
+    exit 2
+fi
+bin=$1
+update=${2:-}
+root=$(cd "$(dirname "$0")/.." && pwd)
+
+status=0
+for recording in "$root"/recordings/*.qqi; do
+    [ -e "$recording" ] || { echo "No recordings in $root/recordings"; exit 0; }
+    name=${recording%.qqi}
+    log="$name.log"
+
+    if [ "$update" = "--update" ]; then
+        "$bin" --replay "$recording" --report "$name.report.csv" > "$log" 2>&1 || status=1
+        checksum=$(sed -n 's/.*Replay checksum (every 1 frames): \([0-9a-f]*\).*/\1/p' "$log")
+        if [ -n "$checksum" ]; then
+            echo "$checksum" > "$name.checksum"
+            echo "UPDATED $(basename "$recording") $checksum"
+        else
+            echo "FAILED  $(basename "$recording"), see $log"
+            status=1
+        fi
+    elif [ -f "$name.checksum" ]; then
+        if "$bin" --replay "$recording" --report "$name.report.csv" --expect "$(cat "$name.checksum")" > "$log" 2>&1; then
+            echo "OK      $(basename "$recording")"
+        else
+            echo "FAILED  $(basename "$recording"), see $log"
+            status=1
+        fi
+    else
+        "$bin" --replay "$recording" --report "$name.report.csv" > "$log" 2>&1 || status=1
+        echo "NOCHECK $(basename "$recording"), no .checksum, timings in $name.report.csv"
+    fi
+done
+exit $status
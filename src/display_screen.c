@@ -2,6 +2,7 @@
 #include <stdio.h>
 
 #include "utilities.h"
+#include "input.h"
 #include "assets.h"
 #include "display_screen.h"
 
@@ -41,36 +42,36 @@ void calculateColumnsWidth(GridData *grid, int *columnsWidth, int textPadding, A
 }
 
 void HandleDisplayZoneKeyShortcuts(Zone *zone, int cellHeight) {
-    if (IsKeyDown(KEY_LEFT_SHIFT)) {
-        if (IsKeyPressed(KEY_HOME)) {
+    if (InputKeyDown(KEY_LEFT_SHIFT)) {
+        if (InputKeyPressed(KEY_HOME)) {
             zone->scroll.x = 0;
         }
-        else if (IsKeyPressed(KEY_END)) {
+        else if (InputKeyPressed(KEY_END)) {
             zone->scroll.x = zone->contentSize.x - zone->bounds.width;
         }
     } else {
-        if (IsKeyPressed(KEY_HOME)) {
+        if (InputKeyPressed(KEY_HOME)) {
             zone->scroll.y = 0;
         }
-        else if (IsKeyPressed(KEY_END)) {
+        else if (InputKeyPressed(KEY_END)) {
             zone->scroll.y = zone->contentSize.y - zone->bounds.height;
         }
-        else if (IsKeyPressed(KEY_PAGE_UP)) {
+        else if (InputKeyPressed(KEY_PAGE_UP)) {
             zone->scroll.y -= zone->bounds.y - cellHeight; // @TODO: Calculate proper size
         }
-        else if (IsKeyPressed(KEY_PAGE_DOWN)) {
+        else if (InputKeyPressed(KEY_PAGE_DOWN)) {
             zone->scroll.y += zone->bounds.y - cellHeight; // @TODO: Calculate proper size
         }
-        else if (IsKeyPressed(KEY_J) || IsKeyPressed(KEY_DOWN)) {
+        else if (InputKeyPressed(KEY_J) || InputKeyPressed(KEY_DOWN)) {
             zone->scroll.y += cellHeight; // @TODO: Calculate proper size
         }
-        else if (IsKeyPressed(KEY_K) || IsKeyPressed(KEY_UP)) {
+        else if (InputKeyPressed(KEY_K) || InputKeyPressed(KEY_UP)) {
             zone->scroll.y -= cellHeight; // @TODO: Calculate proper size
         }
-        else if (IsKeyPressed(KEY_H) || IsKeyPressed(KEY_LEFT)) {
+        else if (InputKeyPressed(KEY_H) || InputKeyPressed(KEY_LEFT)) {
             zone->scroll.x -= 100; // @TODO: Calculate proper size
         }
-        else if (IsKeyPressed(KEY_L) || IsKeyPressed(KEY_RIGHT)) {
+        else if (InputKeyPressed(KEY_L) || InputKeyPressed(KEY_RIGHT)) {
             zone->scroll.x += 100; // @TODO: Calculate proper size
         }
     }
@@ -80,7 +81,7 @@ void HandleDisplayZoneKeyShortcuts(Zone *zone, int cellHeight) {
 
 void DrawDisplayZone(Zone *zone, Assets *assets) {
     ClearBackground(BACKGROUND);
-    Vector2 mouse = GetMousePosition();
+    Vector2 mouse = InputMousePosition();
 
     const int cellHeight = 30;
     const int textPadding = 8;
@@ -0,0 +1,227 @@
+#include "raylib.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "input.h"
+
+#define INPUT_FILE_MAGIC    "QQIR"
+#define INPUT_FILE_VERSION  1
+
+// Every key the zones react to, one bit each in InputFrame
+// @WARN: New shortcuts have to be added here or they will not be recorded, querying any other key
+// while recording or replaying logs a warning
+static const int trackedKeys[] = {
+    KEY_LEFT_SHIFT, KEY_HOME, KEY_END, KEY_PAGE_UP, KEY_PAGE_DOWN,
+    KEY_J, KEY_K, KEY_H, KEY_L, KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT,
+};
+static const int trackedButtons[] = { MOUSE_BUTTON_LEFT, MOUSE_BUTTON_RIGHT, MOUSE_BUTTON_MIDDLE };
+
+// Input seen by the application during a single frame
+// Written raw after an 8 byte header (magic + uint32 version), which makes the file little-endian
+// since every platform we build for is; InitInput() refuses to run on anything else
+typedef struct InputFrame {
+    float mouseX;
+    float mouseY;
+    float wheel;
+    uint16_t screenWidth;
+    uint16_t screenHeight;
+    uint16_t keysDown;          // bit per trackedKeys entry
+    uint16_t keysPressed;
+    uint8_t buttonsPressed;     // bit per trackedButtons entry
+    uint8_t buttonsReleased;
+    uint8_t focused;
+    uint8_t reserved;
+} InputFrame;
+
+_Static_assert(sizeof(InputFrame) == 24, "InputFrame is the on-disk format and must stay 24 bytes");
+
+static struct {
+    InputMode mode;
+    FILE *file;
+    InputFrame current;
+    bool primed;            // current already holds the first replay frame
+} input = {0};
+
+// Untracked codes that were already reported, so each one is only logged once
+static bool warnedKeys[512];
+static bool warnedButtons[8];
+
+static void warnUntracked(const char *kind, int code, bool *warned, int count) {
+    if (input.mode == INPUT_MODE_LIVE) return;
+    if (code >= 0 && code < count) {
+        if (warned[code]) return;
+        warned[code] = true;
+    }
+    TraceLog(LOG_WARNING, "%s %d is not part of the input recording and always reads as released during replay", kind, code);
+}
+
+static bool hostIsLittleEndian(void) {
+    const uint16_t probe = 1;
+    return *(const uint8_t *)&probe == 1;
+}
+
+static int trackedKeyIndex(int key) {
+    for (int i = 0; i < (int)(sizeof(trackedKeys) / sizeof(trackedKeys[0])); i++) {
+        if (trackedKeys[i] == key) return i;
+    }
+    warnUntracked("Key", key, warnedKeys, sizeof(warnedKeys) / sizeof(warnedKeys[0]));
+    return -1;
+}
+
+static int trackedButtonIndex(int button) {
+    for (int i = 0; i < (int)(sizeof(trackedButtons) / sizeof(trackedButtons[0])); i++) {
+        if (trackedButtons[i] == button) return i;
+    }
+    warnUntracked("Mouse button", button, warnedButtons, sizeof(warnedButtons) / sizeof(warnedButtons[0]));
+    return -1;
+}
+
+static void sampleLiveInput(InputFrame *frame) {
+    memset(frame, 0, sizeof(*frame));
+
+    Vector2 mouse = GetMousePosition();
+    frame->mouseX = mouse.x;
+    frame->mouseY = mouse.y;
+    frame->wheel = GetMouseWheelMove();
+    frame->screenWidth = (uint16_t)GetScreenWidth();
+    frame->screenHeight = (uint16_t)GetScreenHeight();
+    frame->focused = IsWindowFocused();
+
+    for (int i = 0; i < (int)(sizeof(trackedKeys) / sizeof(trackedKeys[0])); i++) {
+        if (IsKeyDown(trackedKeys[i])) frame->keysDown |= (1 << i);
+        if (IsKeyPressed(trackedKeys[i])) frame->keysPressed |= (1 << i);
+    }
+    for (int i = 0; i < (int)(sizeof(trackedButtons) / sizeof(trackedButtons[0])); i++) {
+        if (IsMouseButtonPressed(trackedButtons[i])) frame->buttonsPressed |= (1 << i);
+        if (IsMouseButtonReleased(trackedButtons[i])) frame->buttonsReleased |= (1 << i);
+    }
+}
+
+bool InitInput(InputMode mode, const char *fileName) {
+    input.mode = mode;
+    input.file = NULL;
+    input.primed = false;
+    if (mode == INPUT_MODE_LIVE) return true;
+    if (!hostIsLittleEndian()) {
+        TraceLog(LOG_ERROR, "Input recording is only supported on little-endian hosts");
+        input.mode = INPUT_MODE_LIVE;
+        return false;
+    }
+
+    char magic[4];
+    uint32_t version = INPUT_FILE_VERSION;
+    if (mode == INPUT_MODE_RECORD) {
+        input.file = fopen(fileName, "wb");
+        if (input.file == NULL) {
+            TraceLog(LOG_ERROR, "Failed to open input recording %s", fileName);
+            return false;
+        }
+        if (fwrite(INPUT_FILE_MAGIC, 1, 4, input.file) != 4 || fwrite(&version, sizeof(version), 1, input.file) != 1) {
+            TraceLog(LOG_ERROR, "Failed to write input recording header to %s", fileName);
+            CloseInput();
+            return false;
+        }
+        TraceLog(LOG_INFO, "Recording input to %s", fileName);
+        return true;
+    }
+
+    input.file = fopen(fileName, "rb");
+    if (input.file == NULL) {
+        TraceLog(LOG_ERROR, "Failed to open input recording %s", fileName);
+        return false;
+    }
+    if (fread(magic, 1, 4, input.file) != 4 || memcmp(magic, INPUT_FILE_MAGIC, 4) != 0 ||
+        fread(&version, sizeof(version), 1, input.file) != 1 || version != INPUT_FILE_VERSION) {
+        TraceLog(LOG_ERROR, "%s is not a version %d QQ input recording", fileName, INPUT_FILE_VERSION);
+        CloseInput();
+        return false;
+    }
+
+    // Read the first frame up front so the window can be created at the recorded size
+    if (fread(&input.current, sizeof(input.current), 1, input.file) != 1) {
+        TraceLog(LOG_ERROR, "Input recording %s contains no frames", fileName);
+        CloseInput();
+        return false;
+    }
+    input.primed = true;
+    TraceLog(LOG_INFO, "Replaying input from %s", fileName);
+    return true;
+}
+
+void CloseInput(void) {
+    if (input.file != NULL) {
+        // Buffered frames are only flushed here, so a failing close means the recording is truncated
+        if (fclose(input.file) != 0 && input.mode == INPUT_MODE_RECORD) {
+            TraceLog(LOG_ERROR, "Failed to finish writing the input recording, it is truncated");
+        }
+        input.file = NULL;
+    }
+    input.mode = INPUT_MODE_LIVE;
+}
+
+// Fetch the input for this frame, returns false once a replay runs out of frames
+bool PollFrameInput(void) {
+    if (input.mode != INPUT_MODE_REPLAY) {
+        sampleLiveInput(&input.current);
+        if (input.mode == INPUT_MODE_RECORD && fwrite(&input.current, sizeof(input.current), 1, input.file) != 1) {
+            TraceLog(LOG_ERROR, "Failed to write input recording, recording stopped");
+            CloseInput();
+        }
+        return true;
+    }
+
+    if (input.primed) {
+        input.primed = false;
+        return true;
+    }
+    return fread(&input.current, sizeof(input.current), 1, input.file) == 1;
+}
+
+InputMode GetInputMode(void) {
+    return input.mode;
+}
+
+int InputScreenWidth(void) {
+    return input.current.screenWidth;
+}
+
+int InputScreenHeight(void) {
+    return input.current.screenHeight;
+}
+
+bool InputWindowFocused(void) {
+    return input.current.focused;
+}
+
+bool InputKeyDown(int key) {
+    int index = trackedKeyIndex(key);
+    if (index < 0) return input.mode != INPUT_MODE_REPLAY && IsKeyDown(key);
+    return input.current.keysDown & (1 << index);
+}
+
+bool InputKeyPressed(int key) {
+    int index = trackedKeyIndex(key);
+    if (index < 0) return input.mode != INPUT_MODE_REPLAY && IsKeyPressed(key);
+    return input.current.keysPressed & (1 << index);
+}
+
+bool InputMouseButtonPressed(int button) {
+    int index = trackedButtonIndex(button);
+    if (index < 0) return input.mode != INPUT_MODE_REPLAY && IsMouseButtonPressed(button);
+    return input.current.buttonsPressed & (1 << index);
+}
+
+bool InputMouseButtonReleased(int button) {
+    int index = trackedButtonIndex(button);
+    if (index < 0) return input.mode != INPUT_MODE_REPLAY && IsMouseButtonReleased(button);
+    return input.current.buttonsReleased & (1 << index);
+}
+
+Vector2 InputMousePosition(void) {
+    return (Vector2){ input.current.mouseX, input.current.mouseY };
+}
+
+float InputMouseWheelMove(void) {
+    return input.current.wheel;
+}
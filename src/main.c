@@ -1,14 +1,119 @@
 #include "raylib.h"
+#include <stdlib.h>
+#include <limits.h>
+#include <errno.h>
+#include <ctype.h>
+#include <string.h>
 
 #include "utilities.h"
+#include "input.h"
+#include "replay_stats.h"
 #include "assets.h"
 #include "display_screen.h"
 
-int main(void)
+// --record <file> saves every frame's input, --replay <file> plays it back as fast as possible
+// and writes per-frame timings and hashes to --report <file>, --expect <checksum> fails on mismatch,
+// --hash-every <n> only hashes every Nth frame and --no-hash skips hashing for pure timing runs
+typedef struct Options {
+    InputMode inputMode;
+    const char *inputFileName;
+    const char *reportFileName;
+    const char *expectedChecksum;
+    unsigned long long expectedValue;
+    int hashEvery;
+    bool hashOptionGiven;
+} Options;
+
+static bool parseArguments(int argc, char **argv, Options *options) {
+    *options = (Options){ .inputMode = INPUT_MODE_LIVE, .reportFileName = NULL, .hashEvery = 1 };
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool isRecord = strcmp(arg, "--record") == 0;
+        bool isReplay = strcmp(arg, "--replay") == 0;
+        bool isReport = strcmp(arg, "--report") == 0;
+        bool isExpect = strcmp(arg, "--expect") == 0;
+        bool isHashEvery = strcmp(arg, "--hash-every") == 0;
+        if (strcmp(arg, "--no-hash") == 0) {
+            options->hashEvery = 0;
+            options->hashOptionGiven = true;
+            continue;
+        }
+        if (!isRecord && !isReplay && !isReport && !isExpect && !isHashEvery) {
+            TraceLog(LOG_WARNING, "Unknown argument %s", arg);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            TraceLog(LOG_ERROR, "%s needs a value", arg);
+            return false;
+        }
+        const char *value = argv[++i];
+
+        if (isRecord || isReplay) {
+            if (options->inputMode != INPUT_MODE_LIVE) {
+                TraceLog(LOG_ERROR, "Only one of --record and --replay can be given");
+                return false;
+            }
+            options->inputMode = isRecord ? INPUT_MODE_RECORD : INPUT_MODE_REPLAY;
+            options->inputFileName = value;
+        } else if (isReport) {
+            options->reportFileName = value;
+        } else if (isHashEvery) {
+            char *end = NULL;
+            long hashEvery = strtol(value, &end, 10);
+            if (*value == '\0' || *end != '\0' || hashEvery < 1 || hashEvery > INT_MAX) {
+                TraceLog(LOG_ERROR, "--hash-every needs a positive frame count, got %s", value);
+                return false;
+            }
+            options->hashEvery = (int)hashEvery;
+            options->hashOptionGiven = true;
+        } else {
+            // Require a full hex number, a typo should not turn into a "checksum does not match" failure
+            char *end = NULL;
+            errno = 0;
+            options->expectedValue = strtoull(value, &end, 16);
+            if (!isxdigit((unsigned char)*value) || *end != '\0' || errno == ERANGE) {
+                TraceLog(LOG_ERROR, "--expect needs a hexadecimal checksum, got %s", value);
+                return false;
+            }
+            options->expectedChecksum = value;
+        }
+    }
+
+    if (options->inputMode != INPUT_MODE_REPLAY && (options->reportFileName != NULL || options->expectedChecksum != NULL || options->hashOptionGiven)) {
+        TraceLog(LOG_ERROR, "--report, --expect, --hash-every and --no-hash can only be used with --replay");
+        return false;
+    }
+    if (options->expectedChecksum != NULL && options->hashEvery == 0) {
+        TraceLog(LOG_ERROR, "--expect can not be combined with --no-hash");
+        return false;
+    }
+    if (options->reportFileName == NULL) options->reportFileName = "replay_report.csv";
+    return true;
+}
+
+int main(int argc, char **argv)
 {
+    Options options;
+    if (!parseArguments(argc, argv, &options)) return 1;
+    InputMode inputMode = options.inputMode;
+
+    // @WARN: Files need to be opened before LoadAssets changes the working directory
+    ReplayStats replayStats = {0};
+    if (!InitInput(inputMode, options.inputFileName)) return 1;
+    if (inputMode == INPUT_MODE_REPLAY && !InitReplayStats(&replayStats, options.reportFileName, options.hashEvery)) {
+        CloseInput();
+        return 1;
+    }
+
     int screenWidth = GetScreenWidth();
     int screenHeight = GetScreenHeight();
-    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    if (inputMode == INPUT_MODE_REPLAY) {
+        // Replay opens a fixed window at the recorded size, later resizes only affect the replay target
+        screenWidth = InputScreenWidth() < 100 ? 100 : InputScreenWidth();
+        screenHeight = InputScreenHeight() < 100 ? 100 : InputScreenHeight();
+    } else {
+        SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    }
     InitWindow(screenWidth, screenHeight, "QQ");
 
     Assets assets = {0};
@@ -26,13 +131,16 @@ int main(void)
     topZone.contentSize = (Vector2){1600, 1200};
     bottomZone.contentSize = (Vector2){2000, 2000};
 
-    SetTargetFPS(60);
+    // Nothing depends on frame time, so an uncapped replay still steps through the same states
+    SetTargetFPS(inputMode == INPUT_MODE_REPLAY ? 0 : 60);
 
     while (!WindowShouldClose())
     {
-        screenWidth = GetScreenWidth();
+        if (!PollFrameInput()) break;
+
+        screenWidth = InputScreenWidth();
         if (screenWidth < 100) screenWidth = 100;
-        screenHeight = GetScreenHeight();
+        screenHeight = InputScreenHeight();
         if (screenHeight < 100) screenHeight = 100;
 
         SetMouseCursor(MOUSE_CURSOR_DEFAULT);
@@ -54,6 +162,7 @@ int main(void)
 
         // --- Drawing ---
         BeginDrawing();
+        if (inputMode == INPUT_MODE_REPLAY) BeginReplayFrame(&replayStats, screenWidth, screenHeight);
         ClearBackground(BACKGROUND);
 
         // DrawTextEx(fnt, "Font test", (Vector2){50, 50}, 32, 2.0f, TEXT);
@@ -63,11 +172,22 @@ int main(void)
 
         DrawRectangleRec(splitter.rect, splitter.dragging ? CRUST : SURFACE_1);
 
+        if (inputMode == INPUT_MODE_REPLAY) EndReplayFrame(&replayStats);
         EndDrawing();
     }
 
+    int exitCode = 0;
+    if (inputMode == INPUT_MODE_REPLAY) {
+        CloseReplayStats(&replayStats);
+        if (options.expectedChecksum != NULL && options.expectedValue != replayStats.checksum) {
+            TraceLog(LOG_ERROR, "Replay checksum does not match expected %s", options.expectedChecksum);
+            exitCode = 1;
+        }
+    }
+    CloseInput();
+
     UnloadAssets(&assets);
     CloseWindow();
-    return 0;
+    return exitCode;
 }
 
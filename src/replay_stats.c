@@ -0,0 +1,108 @@
+#include "raylib.h"
+#include <stdio.h>
+#include <stdint.h>
+
+#include "replay_stats.h"
+
+#define FNV_OFFSET_BASIS    14695981039346656037ULL
+#define FNV_PRIME           1099511628211ULL
+
+static uint64_t hashBytes(const unsigned char *bytes, int size, uint64_t hash) {
+    for (int i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// Close the timing of the open frame, a frame lasts until the next one starts
+static void finishFrame(ReplayStats *stats, double now) {
+    if (!stats->inFrame) return;
+    stats->inFrame = false;
+
+    double ms = (now - stats->frameStart) * 1000.0;
+    stats->totalMs += ms;
+    if (stats->minMs < 0 || ms < stats->minMs) stats->minMs = ms;
+    if (ms > stats->maxMs) stats->maxMs = ms;
+
+    if (stats->frameHashed) {
+        fprintf(stats->report, "%d,%.4f,%016llx\n", stats->frames, ms, (unsigned long long)stats->frameHash);
+    } else {
+        fprintf(stats->report, "%d,%.4f,\n", stats->frames, ms);
+    }
+    stats->frames++;
+}
+
+bool InitReplayStats(ReplayStats *stats, const char *reportFileName, int hashEvery) {
+    *stats = (ReplayStats){0};
+    stats->hashEvery = hashEvery;
+    stats->minMs = -1.0;
+    stats->checksum = FNV_OFFSET_BASIS;
+
+    stats->report = fopen(reportFileName, "w");
+    if (stats->report == NULL) {
+        TraceLog(LOG_ERROR, "Failed to open replay report %s", reportFileName);
+        return false;
+    }
+    fprintf(stats->report, "frame,ms,hash\n");
+    return true;
+}
+
+void CloseReplayStats(ReplayStats *stats) {
+    if (stats->report == NULL) return;
+    finishFrame(stats, GetTime());
+    if (stats->target.id != 0) {
+        UnloadRenderTexture(stats->target);
+        stats->target = (RenderTexture2D){0};
+    }
+    fclose(stats->report);
+    stats->report = NULL;
+
+    if (stats->frames == 0) {
+        TraceLog(LOG_WARNING, "Replay finished without any frames");
+        return;
+    }
+    TraceLog(LOG_INFO, "Replay: %d frames, avg %.3f ms, min %.3f ms, max %.3f ms",
+        stats->frames, stats->totalMs / stats->frames, stats->minMs, stats->maxMs);
+    if (stats->hashEvery > 0) {
+        TraceLog(LOG_INFO, "Replay checksum (every %d frames): %016llx", stats->hashEvery, (unsigned long long)stats->checksum);
+    } else {
+        TraceLog(LOG_INFO, "Replay checksum: not computed, hashing disabled");
+    }
+}
+
+// Call right after BeginDrawing(), everything drawn until EndReplayFrame() lands in the replay target
+void BeginReplayFrame(ReplayStats *stats, int width, int height) {
+    // Timing runs from one frame start to the next, so update, drawing, EndDrawing() and input polling all count
+    double now = GetTime();
+    finishFrame(stats, now);
+    stats->inFrame = true;
+    stats->frameStart = now;
+    stats->frameHashed = false;
+
+    // Follow resizes from the recording, the OS window itself is never resized
+    if (stats->target.id == 0 || stats->target.texture.width != width || stats->target.texture.height != height) {
+        if (stats->target.id != 0) UnloadRenderTexture(stats->target);
+        stats->target = LoadRenderTexture(width, height);
+    }
+    BeginTextureMode(stats->target);
+}
+
+// Call right before EndDrawing()
+void EndReplayFrame(ReplayStats *stats) {
+    EndTextureMode();
+
+    // Reading the target back stalls the GPU and counts towards this frame, use hashEvery 0 for timing runs
+    if (stats->hashEvery > 0 && stats->frames % stats->hashEvery == 0) {
+        Image frame = LoadImageFromTexture(stats->target.texture);
+        stats->frameHash = hashBytes(frame.data, GetPixelDataSize(frame.width, frame.height, frame.format), FNV_OFFSET_BASIS);
+        stats->frameHashed = true;
+        UnloadImage(frame);
+        stats->checksum = hashBytes((const unsigned char *)&stats->frameHash, sizeof(stats->frameHash), stats->checksum);
+    }
+
+    // Render textures are stored upside down, flip while showing the frame in the window
+    ClearBackground(BLACK);
+    Rectangle source = { 0, 0, (float)stats->target.texture.width, -(float)stats->target.texture.height };
+    DrawTextureRec(stats->target.texture, source, (Vector2){ 0, 0 }, WHITE);
+}
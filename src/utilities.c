@@ -3,6 +3,7 @@
 #include <stdlib.h>
 
 #include "utilities.h"
+#include "input.h"
 
 // Clamp scroll so it never exceeds content limits
 void ClampZoneScroll(Zone *zone) {
@@ -17,12 +18,12 @@ void ClampZoneScroll(Zone *zone) {
 // Helper: check whether mouse is inside main window area
 // (useful to cancel dragging if cursor leaves window)
 bool MouseInsideWindow(void) {
-    Vector2 m = GetMousePosition();
-    return (m.x >= 0 && m.y >= 0 && m.x <= GetScreenWidth() && m.y <= GetScreenHeight());
+    Vector2 m = InputMousePosition();
+    return (m.x >= 0 && m.y >= 0 && m.x <= InputScreenWidth() && m.y <= InputScreenHeight());
 }
 
 bool MouseInsideZone(Zone *zone) {
-    Vector2 m = GetMousePosition();
+    Vector2 m = InputMousePosition();
     return (m.x >= zone->bounds.x && m.y >= zone->bounds.y && m.x <= zone->bounds.x + zone->bounds.width && m.y <= zone->bounds.y + zone->bounds.height);
 }
 
@@ -30,12 +31,12 @@ void HandleZoneSplit(Splitter *splitter, int screenWidth, int screenHeight) {
     // Convert ratio -> Y position
     splitter->y = splitter->ratio * screenHeight;
 
-    Vector2 mouse = GetMousePosition();
+    Vector2 mouse = InputMousePosition();
     // Handle splitter drag
     splitter->rect = (Rectangle){0, splitter->y - splitter->height/2, (float)screenWidth, splitter->height};
-    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, splitter->rect))
+    if (InputMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, splitter->rect))
         splitter->dragging = true;
-    if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
+    if (InputMouseButtonReleased(MOUSE_BUTTON_LEFT))
         splitter->dragging = false;
     if (splitter->dragging) {
         SetMouseCursor(MOUSE_CURSOR_RESIZE_NS);
@@ -71,9 +72,9 @@ void InitZoneScrollbars(Zone *z) {
 // Helper: handle mouse wheel and drag to scroll
 void UpdateZoneScroll(Zone *zone) {
     InitZoneScrollbars(zone);
-    Vector2 mouse = GetMousePosition();
+    Vector2 mouse = InputMousePosition();
 
-    if (!IsWindowFocused() || !MouseInsideZone(zone)) {
+    if (!InputWindowFocused() || !MouseInsideZone(zone)) {
         zone->vScrollbar.dragging = false;
         zone->hScrollbar.dragging = false;
     }
@@ -81,20 +82,20 @@ void UpdateZoneScroll(Zone *zone) {
     // Only scroll if mouse inside the zone
     if (CheckCollisionPointRec(mouse, zone->bounds))
     {
-        if (IsKeyDown(KEY_LEFT_SHIFT)) {
+        if (InputKeyDown(KEY_LEFT_SHIFT)) {
             // Mouse wheel scroll (horizontal)
-            zone->scroll.x -= GetMouseWheelMove() * 40;
+            zone->scroll.x -= InputMouseWheelMove() * 40;
         } else {
             // Mouse wheel scroll (vertical)
-            zone->scroll.y -= GetMouseWheelMove() * 40;
+            zone->scroll.y -= InputMouseWheelMove() * 40;
         }
 
         // Handle dragging vertical scrollbar
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, zone->vScrollbar.thumb)) {
+        if (InputMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, zone->vScrollbar.thumb)) {
             zone->vScrollbar.dragging = true;
             zone->vScrollbar.grabOffset = mouse.y - zone->vScrollbar.thumb.y;
         }
-        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) zone->vScrollbar.dragging = false;
+        if (InputMouseButtonReleased(MOUSE_BUTTON_LEFT)) zone->vScrollbar.dragging = false;
 
         if (zone->vScrollbar.dragging) {
             SetMouseCursor(MOUSE_CURSOR_POINTING_HAND);
@@ -107,11 +108,11 @@ void UpdateZoneScroll(Zone *zone) {
         }
 
         // Handle dragging horizontal scrollbar
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, zone->hScrollbar.thumb)) {
+        if (InputMouseButtonPressed(MOUSE_BUTTON_LEFT) && CheckCollisionPointRec(mouse, zone->hScrollbar.thumb)) {
             zone->hScrollbar.dragging = true;
             zone->hScrollbar.grabOffset = mouse.x - zone->hScrollbar.thumb.x;
         }
-        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) zone->hScrollbar.dragging = false;
+        if (InputMouseButtonReleased(MOUSE_BUTTON_LEFT)) zone->hScrollbar.dragging = false;
 
         if (zone->hScrollbar.dragging) {
             SetMouseCursor(MOUSE_CURSOR_POINTING_HAND);